@@ -0,0 +1,234 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "exec.h"
+
+// define if debug output wanted
+//#define DEBUGBATCH
+
+#define BATCHSIZE 1024                  // tuples in a batch
+
+
+// The iterators of exec.h hand tuples up one at a time, so every tuple
+// pays for a virtual call and a compiled comparator call per operator.
+// The batch iterators here hand up BATCHSIZE tuples at a time instead,
+// stored by column: each attribute of the tuples has an array of its
+// own, attrLen bytes per tuple.  Each operator then runs one tight
+// loop per column, with the type of the attribute and the comparison
+// fixed at compile time (see batch.C), rather than one dispatch per
+// tuple.
+//
+// A batch also has a selection vector: the positions, in increasing
+// order, of the tuples in the columns that are still part of it.  A
+// filter only shortens the selection vector and leaves the columns
+// alone.
+//
+// A batch iterator describes its attributes with AttrDescs, like an
+// Iterator; their attrOffsets are those of the attributes in a row of
+// the tuples, as RowIter returns them.
+
+struct Batch
+{
+  int		tupleCnt;		// tuples in the columns
+  vector<char*>	cols;			// where column i is
+  vector<int>	sel;			// the tuples in the batch
+  int		selCnt;
+
+  // storage for the columns of tuples with attributes attrs; cols
+  // points to it unless an operator points cols at columns of another
+  // batch, which are then good until that one is refilled
+  void init(const int attrCnt, const AttrDesc attrs[]);
+
+  // select all tupleCnt tuples
+  void selectAll();
+
+  vector<vector<char> > data;
+};
+
+
+class BatchIterator
+{
+public:
+  virtual ~BatchIterator() {}
+
+  // as for an Iterator; next() returns a batch with at least one
+  // tuple selected, or NOMORERECS.  batch must have been set up with
+  // init() for the attributes of the iterator.
+  virtual const Status open() = 0;
+  virtual const Status next(Batch & batch) = 0;
+  virtual const Status close() = 0;
+
+  const int getAttrCnt() const { return attrs.size(); }
+  const AttrDesc* getAttrs() const { return &attrs[0]; }
+  const int getTupleLen() const { return tupleLen; }
+  const int findAttr(const char* relName, const char* attrName) const;
+
+protected:
+  vector<AttrDesc> attrs;
+  int		tupleLen;
+
+  // take attributes attrs, laid out in a row one after the other
+  void setAttrs(const int attrCnt, const AttrDesc attrs[]);
+};
+
+
+// Keep the selected tuples of batch that satisfy the AND of predCnt
+// terms, whose offsets are those of the attributes in a row.
+void filterBatch(Batch & batch, const int attrCnt, const AttrDesc attrs[],
+		 const int predCnt, const ScanPred preds[]);
+
+
+// The records of a relation that satisfy the AND of predCnt terms.
+// A page of records at a time comes from HeapFileScan::scanNextPage(),
+// which skips the pages that the zone map rules out for the terms.  The
+// columns of the terms are copied and the terms evaluated on them; the
+// other columns are copied only for the records that satisfy them.  A
+// row of the tuples is a record of the relation.
+
+class BatchScan : public BatchIterator
+{
+public:
+  BatchScan(const string & relation, const int predCnt,
+	    const ScanPred preds[], Status & status);
+  ~BatchScan();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+private:
+  string	relation;
+  vector<ScanPred> preds;
+  vector<bool>	predCol;		// is attribute i in a term?
+  HeapFileScan*	scan;			// while open
+  vector<Record> page;			// records of the page read last
+  unsigned int	pageNo;			// next one of them to copy
+  bool		done;			// has the scan ended?
+};
+
+
+// The tuples of child that satisfy the AND of predCnt terms, whose
+// offsets are those of the attributes in a row of child.  It owns
+// child, as every batch iterator over other ones does.
+
+class BatchFilter : public BatchIterator
+{
+public:
+  BatchFilter(BatchIterator* child, const int predCnt,
+	      const ScanPred preds[]);
+  ~BatchFilter();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+private:
+  BatchIterator* child;
+  vector<ScanPred> preds;
+};
+
+
+// The tuples of child cut down to projCnt of its attributes, found by
+// relation and attribute name.  No data is copied: the columns of a
+// batch are those of child's.
+
+class BatchProject : public BatchIterator
+{
+public:
+  BatchProject(BatchIterator* child, const int projCnt,
+	       const AttrDesc projs[], Status & status);
+  ~BatchProject();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+private:
+  BatchIterator* child;
+  vector<int>	from;			// column of each in child
+  Batch		in;
+};
+
+
+// Equijoin of the tuples of outer and inner on outer.attr1 =
+// inner.attr2 (attribute numbers).  open() reads all of inner into a
+// hash table in memory; each batch of outer is then probed a column at
+// a time.  A tuple of the join is the outer tuple followed by the
+// inner one.
+
+class BatchHashJoin : public BatchIterator
+{
+public:
+  BatchHashJoin(BatchIterator* outer, BatchIterator* inner,
+		const int attr1, const int attr2, Status & status);
+  ~BatchHashJoin();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+private:
+  BatchIterator* outer;
+  BatchIterator* inner;
+  int		attr1, attr2;
+  int		outerCnt;		// attributes of outer
+
+  vector<char>	rows;			// the inner tuples, as rows
+  int		rowCnt;
+  vector<int>	heads;			// first row of each hash chain
+  vector<int>	chain;			// next row on the chain of a row
+  unsigned int	mask;			// hash value -> chain
+
+  Batch		probe;			// the outer batch being probed
+  bool		probing;		// is there one?
+  vector<unsigned int> hashes;		// hash values of its join column
+  int		selNo;			// the next of its tuples to probe
+  int		rowNo;			// and the next row on its chain
+  vector<int>	outerPos, innerRow;	// the matches of a batch
+};
+
+
+// The tuples of child in the order of attribute attrNo.  open() reads
+// all of child into memory as rows and sorts them; next() copies them
+// back into columns.  SortIter sorts an input that does not fit.
+
+class BatchSort : public BatchIterator
+{
+public:
+  BatchSort(BatchIterator* child, const int attrNo);
+  ~BatchSort();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+private:
+  BatchIterator* child;
+  int		attrNo;
+  vector<char>	rows;
+  vector<int>	order;			// row offsets in sorted order
+  unsigned int	orderNo;		// the next one to return
+};
+
+
+// The tuples of the batches of child one at a time, as rows, so that a
+// batch plan can be run by runPlan().  Owns child.
+
+class RowIter : public Iterator
+{
+public:
+  RowIter(BatchIterator* child);
+  ~RowIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  BatchIterator* child;
+  Batch		batch;
+  int		selNo;			// next selected tuple to return
+  vector<char>	tuple;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef BITMAPINDEX_H
+#define BITMAPINDEX_H
+
+#include "index.h"
+
+// A bitmap index keeps, for every distinct value of one attribute of
+// a relation, the set of records that hold it.  It suits attributes
+// with few distinct values, where a B+-tree or hash index would hold
+// long runs of entries with the same key, and it lets a selection
+// combine the terms on several such attributes before any record is
+// read (see QU_Select()).
+//
+// A record is a bit position, pageNo * BMSLOTS + slotNo, so the
+// positions of a set come out in page order.  The positions are split
+// into containers of BMSPAN, as in a roaring bitmap: a container holds
+// a sorted array of the low 16 bits of its positions while there are
+// at most BMMAXARRAY of them, and a bitmap of all BMSPAN positions
+// beyond that, so it never takes more than 2 bytes a position.  It is
+// kept on as many pages of the index file as it needs, at most
+// BMCONTPAGES.  A value with no records in a span has no container
+// for it.
+//
+// The values, sorted, with the count and page numbers of each of
+// their containers make up the directory, which is read when the
+// index is opened and written back to a chain of pages when it is
+// closed.
+
+const int BMSLOTS = 256;		// positions per heap page
+const int BMSPAN = 1 << 16;		// positions per container
+const int BMMAXARRAY = BMSPAN / 16;	// positions of an array container
+const int BMCONTPAGES = BMSPAN / 8 / PAGESIZE;	// pages of a bitmap
+
+struct BMHdrPage
+{
+  int		attrOffset;		// offset of the key in a record
+  int		attrType;		// Datatype of the key
+  int		attrLen;		// length of the key
+  int		valueCnt;		// distinct values
+  int		entryCnt;		// records in the index
+  int		dirPage;		// first directory page, -1 if none
+};
+
+
+// A set of bit positions in memory, held in containers like those of
+// the index.  Selections build one per term and combine them.
+
+class Bitmap
+{
+public:
+  Bitmap() : curCont(0), curPos(0) {}
+
+  const int count() const;
+
+  // this = this OR other / this AND other / this AND NOT other
+  void unionWith(const Bitmap & other);
+  void intersectWith(const Bitmap & other);
+  void subtract(const Bitmap & other);
+
+  // go through the positions in order
+  void rewind() { curCont = 0; curPos = 0; }
+  bool next(int & pos);
+
+private:
+  struct Container
+  {
+    int			cidx;		// position / BMSPAN
+    int			card;		// positions in it
+    vector<unsigned short> array;	// if card <= BMMAXARRAY
+    vector<unsigned char> bits;		// otherwise
+  };
+
+  // add / remove one position of a container; false if it is already
+  // in / not in it
+  static bool add(Container & c, const unsigned short low);
+  static bool remove(Container & c, const unsigned short low);
+
+  vector<Container> containers;		// by cidx
+  unsigned int curCont;			// next position of next()
+  int curPos;
+
+  static void toBits(Container & c);
+  static void toArray(Container & c);
+  static void unite(Container & c, const Container & other);
+  static void intersect(Container & c, const Container & other);
+  static void subtract(Container & c, const Container & other);
+
+  friend class BitmapIndex;
+};
+
+
+class BitmapIndex : public Index
+{
+public:
+  // create the (empty) index on an attribute of relation
+  static const Status create(const string & relation,
+			     const string & attrName,
+			     const int attrOffset,
+			     const int attrType,
+			     const int attrLen);
+
+  // destroy the index on an attribute of relation
+  static const Status destroy(const string & relation,
+			      const string & attrName);
+
+  // open the index on an attribute of relation
+  BitmapIndex(const string & relation, const string & attrName,
+	      Status & status);
+  ~BitmapIndex();
+
+  // add / remove the entry for the record rec with RID rid
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+
+  // the records whose keys k satisfy `k op value', as the union of
+  // the bitmaps of those values
+  const Status getBitmap(const char* value, const Operator op,
+			 Bitmap & result);
+
+  // start a scan of the records whose keys k satisfy `k op value',
+  // or of the records in positions
+  const Status startScan(const char* value, const Operator op);
+  const Status startScan(const Bitmap & positions);
+
+  // return the RID of the next record of the scan, NOMORERECS at end
+  const Status scanNext(RID & outRid);
+
+  // terminate the scan
+  const Status endScan();
+
+  const int getEntryCnt() const { return hdr->entryCnt; }
+  const int getValueCnt() const { return hdr->valueCnt; }
+
+private:
+  struct BMContainer
+  {
+    int		cidx;			// position / BMSPAN
+    int		card;			// positions in it
+    int		pageNos[BMCONTPAGES];	// its pages, pageCnt(card) of them
+  };
+
+  struct BMValue
+  {
+    vector<char> key;
+    vector<BMContainer> containers;	// by cidx
+  };
+
+  File*		filePtr;		// the index file
+  int		hdrPageNo;		// page number of its header page
+  BMHdrPage*	hdr;			// header page, pinned
+  bool		dirDirty;		// directory changed since read?
+  int		keyLen;			// bytes of a key
+
+  vector<BMValue> values;		// the directory, by key
+  Bitmap	scanBits;		// positions of the scan
+  bool		scanning;
+
+  const int keyCmp(const char* a, const char* b) const;
+  void makeKey(const char* value, char key[]) const;
+  const int findValue(const char* key, bool & found) const;
+  const int findContainer(const BMValue & value, const int cidx,
+			  bool & found) const;
+  static const int pageCnt(const int card);
+  const Status readContainer(const BMContainer & cont,
+			     Bitmap::Container & c);
+  const Status writeContainer(BMContainer & cont,
+			      const Bitmap::Container & c);
+  const Status loadValue(const BMValue & value, Bitmap & bits);
+  const Status readDirectory();
+  const Status writeDirectory();
+};
+
+#endif
@@ -0,0 +1,215 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "index.h"
+
+// A B+-tree index maps the values of one attribute of a relation to
+// the RIDs of the records that hold them.  Its pages are kept in a
+// file of their own and are read and written through the buffer
+// manager like those of a heap file.  After the header page, every
+// page is a node: a BTNodeHdr followed by keyCnt entries.
+//
+// A leaf entry is the key (attrLen bytes, as stored in the record)
+// followed by the RID of the record.  Key and RID together are the
+// sort order of the tree, which makes every entry unique even when
+// keys repeat and lets a delete go straight to the entry of one
+// record.  The leaves of a level are chained through nextPage, so a
+// range scan descends once and then walks the chain.
+//
+// An internal node starts with the page number of its leftmost child;
+// each entry after it is a separator (key and RID) and the child that
+// holds the entries greater than or equal to the separator.
+//
+// The entries of integer and float keys have a fixed length.  String
+// keys are long and mostly null padding, so the nodes of a string
+// index are prefix compressed: the bytes that all keys of a node
+// start with are kept once, after the BTNodeHdr, as a BTPrefixHdr and
+// the prefix, and each entry keeps only the rest of its key up to the
+// last non-null byte.  An array of the offsets of the entries comes
+// before them, so a node is still searched by bisection, on the
+// compressed entries.  When a leaf is split the separator passed up
+// is cut down to the shortest key that still tells the two leaves
+// apart, which keeps the entries of the upper levels short.
+//
+// A leaf entry may also carry other attributes of the record after
+// its RID, named when the index is built.  A query whose attributes
+// all come from one entry is then answered from the leaves without
+// reading the relation (see QU_Select()).  Internal nodes hold no
+// more than key and RID.
+//
+// Nodes are split when they overflow but are not merged when entries
+// are deleted; an emptied leaf stays in the chain until the index is
+// rebuilt (see UT_BuildIndex()).
+//
+// An index over an existing relation is built with bulkLoad() rather
+// than with one insertEntry() per record: the entries are sorted
+// first, and the leaves are then filled to a fill factor and written
+// left to right, with the levels above growing as the leaves do.
+// The room left free on each node absorbs later inserts without
+// splitting right away.
+
+class SortedFile;
+
+const int BTFILLFACTOR = 90;		// default fill factor, in percent
+const int BTMAXINCLUDE = 8;		// attributes a leaf entry may carry
+
+struct BTNodeHdr
+{
+  int		level;			// 0 for leaves
+  int		keyCnt;			// number of entries on the page
+  int		nextPage;		// right sibling, -1 if none
+};
+
+struct BTPrefixHdr			// of a prefix compressed node
+{
+  unsigned short pfxLen;		// bytes of the common prefix
+};
+
+struct BTIncluded			// attributes carried by leaf entries
+{
+  int		cnt;
+  int		offset[BTMAXINCLUDE];	// in a record, in entry order
+  int		len[BTMAXINCLUDE];
+};
+
+struct BTHdrPage
+{
+  int		rootPage;		// page number of the root
+  int		height;			// levels, 1 if the root is a leaf
+  int		attrOffset;		// offset of the key in a record
+  int		attrType;		// Datatype of the key
+  int		attrLen;		// length of the key
+  int		entryCnt;		// entries in the index
+  BTIncluded	included;
+  int		fillFactor;		// of the nodes it is loaded with
+};
+
+
+class BTreeIndex : public Index
+{
+public:
+  // create the (empty) index on an attribute of relation, whose leaf
+  // entries carry the included attributes, if any; fillFactor is kept
+  // for loading the index again
+  static const Status create(const string & relation,
+			     const string & attrName,
+			     const int attrOffset,
+			     const int attrType,
+			     const int attrLen,
+			     const BTIncluded* included = NULL,
+			     const int fillFactor = BTFILLFACTOR);
+
+  // destroy the index on an attribute of relation
+  static const Status destroy(const string & relation,
+			      const string & attrName);
+
+  // open the index on an attribute of relation
+  BTreeIndex(const string & relation, const string & attrName,
+	     Status & status);
+  ~BTreeIndex();
+
+  // add / remove the entry for the record rec with RID rid
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+
+  // fill the empty index with the entries sorted returns (a keysOnly
+  // SortedFile on the attribute that carries the included attributes),
+  // fillFactor percent of each node full
+  const Status bulkLoad(SortedFile & sorted, const int fillFactor);
+
+  // Start a scan of the entries whose keys k satisfy
+  // `k lowOp lowVal' and `k highOp highVal'.  lowOp is GT or GTE and
+  // highOp LT or LTE; a bound whose value is NULL is left open.
+  const Status startScan(const char* lowVal, const Operator lowOp,
+			 const char* highVal, const Operator highOp);
+
+  // return the RID of the next entry of the scan, NOMORERECS at end
+  const Status scanNext(RID & outRid);
+
+  // copy the key and the included attributes of the entry scanNext()
+  // returned last into rec, at their offsets in the record; the other
+  // bytes of rec, which has room for getCoveredLen(), are left alone
+  void getCovered(char* rec) const;
+
+  // terminate the scan
+  const Status endScan();
+
+  // is the attribute at attrOffset the key or an included attribute?
+  const bool covers(const int attrOffset) const;
+
+  const int getEntryCnt() const { return hdr->entryCnt; }
+  const int getHeight() const { return hdr->height; }
+  const BTIncluded & getIncluded() const { return hdr->included; }
+  const int getFillFactor() const { return hdr->fillFactor; }
+  const int getCoveredLen() const { return coveredLen; }
+
+private:
+  File*		filePtr;		// the index file
+  int		hdrPageNo;		// page number of its header page
+  BTHdrPage*	hdr;			// header page, pinned
+  bool		hdrDirty;
+
+  int		keyLen;			// bytes of a key
+  int		incLen;			// bytes of the included attributes
+  int		coveredLen;		// end of the last covered attribute
+  bool		compressed;		// are the nodes prefix compressed?
+  int		leafCap;		// entries that fit on a leaf and
+  int		nodeCap;		// an internal node, if not compressed
+
+  int		scanPageNo;		// leaf the scan is on, -1 if none
+  char*		scanNode;		// that leaf, pinned
+  int		scanPos;		// next entry of it to return
+  const char*	scanEntry;		// entry last returned, in scanBuf
+  vector<char>	scanBuf;		// or on the leaf
+  bool		scanHigh;		// is there an upper bound?
+  vector<char>	highKey;		// upper bound of the scan
+  Operator	highOp;
+
+  // a node being filled by bulkLoad(): its page, pinned, and its
+  // entries and children
+  struct BTLoadNode
+  {
+    int		pageNo;
+    char*	page;
+    vector<char> ents;
+    vector<int>	children;
+  };
+
+  // entry i of a node, key, RID and included attributes, and child c
+  // of an internal node
+  const char* getEntry(char* node, const int i, char buf[]) const;
+  char* childPtr(char* node, const int c) const;
+  int getChild(char* node, const int c) const;
+
+  // unpack all of the entries (and children) of a node / pack them
+  // into a node, and the bytes that takes
+  void readNode(char* node, vector<char> & ents,
+		vector<int> & children) const;
+  void writeNode(char* node, const int level, const int nextPage,
+		 const char* ents, const int cnt, const int* children) const;
+  const int packedSize(const int level, const int cnt, const int pfxLen,
+		       const int keyTotal) const;
+  const int nodeSize(const int level, const char* ents, const int cnt) const;
+  const int fillLimit(const int level, const int fillFactor) const;
+
+  const int keyCmp(const char* a, const char* b) const;
+  const int entryCmp(const char* a, const char* b) const;
+  const int compareAt(char* node, const int i, const char* entry,
+		      const int pfxCmp) const;
+  void makeKey(const char* value, char key[]) const;
+  void separator(const char* left, const char* right, char sep[]) const;
+  const int splitPoint(const int level, const char* ents,
+		       const int cnt) const;
+  const int search(char* node, const char* entry, const bool upper) const;
+  const int lowerBound(char* node, const char* entry) const;
+  const int childIndex(char* node, const char* entry) const;
+  const Status findLeaf(const char* entry, int & pageNo, char*& node);
+  const Status insertInto(const int pageNo, const char* entry,
+			  bool & split, char* upEntry, int & upPageNo);
+  const Status addSeparator(vector<BTLoadNode> & nodes,
+			    const unsigned int level, const char* entry,
+			    const int leftPageNo, const int rightPageNo,
+			    const int fillFactor);
+};
+
+#endif
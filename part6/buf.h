@@ -1,6 +1,8 @@
 #ifndef BUF_H
 #define BUF_H
 
+#include <mutex>
+#include <condition_variable>
 #include "db.h"
 // define if debug output wanted
 //#define DEBUGBUF
@@ -55,6 +57,7 @@ private:
   bool 	dirty;	  // true if dirty;  false otherwise
   bool 	valid;   // true if page is valid
   bool  refbit;	 // has this buffer frame been reference recently
+  bool  inIO;	 // is the page being read or written without bufLock?
 
   void Clear() {  // initialize buffer frame for a new user
     	pinCnt = 0;
@@ -62,6 +65,7 @@ private:
 	pageNo = -1;
     	dirty = false;
 	valid = false;
+	inIO = false;
   };
 
   void Set(File* filePtr, int pageNum) { 
@@ -105,8 +109,14 @@ private:
   BufHashTbl*    hashTable;  	// hash table mapping (File, page) to frame
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
-
-  const Status allocBuf(int & frame);   // allocate a free frame.  
+  mutex		 bufLock;	// serializes the public methods, so
+				// scans may run on several threads;
+				// disk reads and writes run without it
+  condition_variable ioDone;	// signalled when a frame leaves inIO
+
+  // allocate a free frame; bufLock is let go while a dirty page is
+  // written out of it
+  const Status allocBuf(int & frame, unique_lock<mutex> & guard);
   const void releaseBuf(int frame); // return unused frame to end of list
   void advanceClock()
   {
@@ -128,6 +138,10 @@ public:
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
+  // frames in the pool, and how many of them no page is pinned in
+  const int getNumBufs() const { return numBufs; }
+  const int unpinnedFrames();
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
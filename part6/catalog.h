@@ -10,6 +10,7 @@
 
 #define RELCATNAME   "relcat"           // name of relation catalog
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
+#define STATCATNAME  "statcat"          // name of statistics catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
 
@@ -70,6 +71,11 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   index kind : integer(4)      (type is IndexKind actually)
+
+
+// kind of index on an attribute; an attribute has at most one
+enum IndexKind { NOTINDEXED, BTREEINDEX, HASHINDEX, BITMAPINDEX };
 
 
 typedef struct {
@@ -78,6 +84,7 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // kind of index on attribute
 } AttrDesc;
 
 
@@ -99,6 +106,11 @@ class AttrCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation, const string & attrName);
 
+  // record the kind of index an attribute has
+  const Status setIndexed(const string & relation,
+			  const string & attrName,
+			  const IndexKind indexed);
+
   // get all attributes of a relation
   const Status getRelInfo(const string & relation, 
 			  int &attrCnt, 
@@ -112,8 +124,66 @@ class AttrCatalog : public HeapFile {
 };
 
 
+// schema of statistics catalog, one tuple per attribute of every
+// relation that has been analyzed:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   page count : integer(4)            (of the relation)
+//   tuple count : integer(4)           (of the relation)
+//   distinct values : integer(4)       (an estimate)
+//   min value : char(8)                (min, max and bounds are keys,
+//   max value : char(8)                 see makeZoneKey() in zonemap.h)
+//   histogram : char(8 * HISTBUCKETS)
+//
+// The histogram is equi-depth: bucket i holds about tupleCnt /
+// HISTBUCKETS of the values, all of them no greater than bounds[i]
+// and greater than bounds[i - 1].
+
+
+#define HISTBUCKETS  16                 // buckets of a histogram
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int pageCnt;                          // data pages of the relation
+  int tupleCnt;                         // tuples in the relation
+  int distinctCnt;                      // distinct values of attribute
+  char minVal[ZONEKEYLEN];              // smallest value
+  char maxVal[ZONEKEYLEN];              // largest value
+  char bounds[HISTBUCKETS][ZONEKEYLEN]; // upper bound of each bucket
+} StatDesc;
+
+
+class StatCatalog : public HeapFile {
+ public:
+  // open statistics catalog
+  StatCatalog(Status &status);
+
+  // get the statistics of an attribute
+  const Status getInfo(const string & relation,
+		       const string & attrName,
+		       StatDesc &record);
+
+  // get the statistics of all attributes of a relation
+  const Status getRelInfo(const string & relation,
+			  int &attrCnt,
+			  StatDesc *&stats);
+
+  // add information to catalog
+  const Status addInfo(StatDesc & record);
+
+  // remove the statistics of a relation, if it has any
+  const Status removeInfo(const string & relation);
+
+  // close statistics catalog
+  ~StatCatalog();
+};
+
+
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
+extern StatCatalog *statCat;
 extern Error error;
 extern Status createHeapFile(const string filename);
 extern Status destroyHeapFile(const string filename);
@@ -0,0 +1,77 @@
+#ifndef COST_H
+#define COST_H
+
+#include "catalog.h"
+#include "query.h"
+
+// define if debug output wanted
+//#define DEBUGCOST
+
+// The costs of the join methods, estimated in pages read or written,
+// with the tuples handled in memory counted at TUPLECOST pages each.
+// Writing the result costs the same whichever method is used, so it
+// is left out.  An input is either a relation, read at the cost of its
+// pages, or the result of a plan of joins, produced again at the cost
+// of the plan each time it is read.  The estimates follow what the
+// methods in join.C do: the block nested loops join makes the smaller
+// input its outer one and the hash join its inner one, so their costs
+// do not depend on which input is called the outer one, while the
+// tuple nested loops and index nested loops joins take the inputs as
+// given.
+
+#define TUPLECOST 0.01                  // of a tuple handled in memory
+#define INDEXPROBE 2                    // pages read by an index probe
+#define THETASEL (1.0 / 3)              // fraction of pairs that satisfy
+					// an inequality other than NE
+#define DEFAULTEQ 10                    // distinct values, if not known
+#define JOINRESERVE 4                   // frames a join keeps for scans
+
+// what the cost of a join depends on of one of its inputs
+struct JoinInput
+{
+  double	pages;			// pages of the input
+  double	scanCost;		// of reading it once
+  double	tuples;			// tuples in it
+  double	distinct;		// values of the join attribute
+  bool		indexed;		// can an index on the join
+					// attribute find the tuples that
+					// match one of the other input?
+};
+
+// the input of a join that is the relation of attribute attr, with
+// its page and tuple counts from its heap file and the distinct values
+// of attr from the statistics catalog, if the relation was analyzed
+// (otherwise every value is taken to be distinct); scanCost is the
+// page count and indexed is false
+const Status joinInput(const AttrDesc & attr, JoinInput & input);
+
+// the fraction of the tuples of the relation of attr for which
+// `attr op value' holds for a given value; without statistics on attr,
+// one in DEFAULTEQ values is taken to be equal to it
+const double selectSel(const AttrDesc & attr, const Operator op);
+
+// the fraction of the pairs of tuples of outer and inner for which
+// `outer.attr1 op inner.attr2' holds
+const double joinSel(const JoinInput & outer, const JoinInput & inner,
+		     const Operator op);
+
+// the cost of joining outer and inner on `outer.attr1 op inner.attr2'
+// by method when frames frames of the buffer pool are free; negative
+// if method cannot do the join
+const double joinCost(const JoinType method, const JoinInput & outer,
+		      const JoinInput & inner, const Operator op,
+		      const int frames);
+
+// the method of least cost for `in1.attr1 op in2.attr2', and whether
+// it costs least with in2 as the outer input (and op reversed).  If
+// only is not AutoJoin, it is the method, or BNLJoin where it cannot
+// do the join.
+const double cheapestJoin(const JoinInput & in1, const JoinInput & in2,
+			  const Operator op, const int frames,
+			  const JoinType only, JoinType & method,
+			  bool & swapped);
+
+// the operator that holds for (b, a) when op holds for (a, b)
+const Operator reverseOp(const Operator op);
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <sys/types.h>
 #include <functional>
+#include <mutex>
 #include "error.h"
 #include <string.h>
 using namespace std;
@@ -111,6 +112,7 @@ class DB {
 
  private:
   OpenFileHashTbl   openFiles;    // list of open files
+  mutex             dbLock;       // protects openFiles and open counts
 };
 
 
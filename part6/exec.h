@@ -0,0 +1,539 @@
+#ifndef EXEC_H
+#define EXEC_H
+
+#include "catalog.h"
+#include "index.h"
+
+// define if debug output wanted
+//#define DEBUGEXEC
+
+class SortedFile;
+class ParallelScan;
+class BTreeIndex;
+
+
+// A query is run as a tree of iterators.  Each one asks its inputs for
+// tuples one at a time with next() and hands its own tuples up the
+// same way, so a tuple goes from the scan that read it through the
+// filters, joins and projections above all the way to the result
+// without being stored in between.  Only an iterator that cannot
+// return a tuple before it has seen all of its input (a sort) keeps
+// its input in a temporary file.
+//
+// The tuples of an iterator have a fixed layout, described by the
+// AttrDesc of each of their attributes: the relation and attribute it
+// comes from and its type, length and offset in the tuple.  A tuple
+// returned by next() lives in storage of the iterator, or of one of
+// its inputs, and is good until the next call.
+
+class Iterator
+{
+public:
+  virtual ~Iterator() {}
+
+  // get ready to return tuples from the first one on; an iterator
+  // may be opened again after it has been closed
+  virtual const Status open() = 0;
+
+  // return the next tuple in rec, NOMORERECS after the last one
+  virtual const Status next(Record & rec) = 0;
+
+  // release what open() acquired
+  virtual const Status close() = 0;
+
+  // the attributes of the tuples, and the bytes of a tuple
+  const int getAttrCnt() const { return attrs.size(); }
+  const AttrDesc* getAttrs() const { return &attrs[0]; }
+  const int getTupleLen() const { return tupleLen; }
+
+  // position of attribute relName.attrName among the attributes, -1
+  // if there is none
+  const int findAttr(const char* relName, const char* attrName) const;
+
+protected:
+  vector<AttrDesc> attrs;
+  int		tupleLen;
+
+  // take the attributes of a relation as those of the tuples
+  const Status setRelation(const string & relation);
+};
+
+
+// The records of a relation that satisfy the AND of predCnt terms,
+// which are evaluated on the page by the HeapFileScan.
+
+class ScanIter : public Iterator
+{
+public:
+  ScanIter(const string & relation, const int predCnt,
+	   const ScanPred preds[], Status & status);
+  ~ScanIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  string	relation;
+  vector<ScanPred> preds;
+  HeapFileScan*	scan;			// while open
+};
+
+
+// A scan of a relation split across worker threads (see ParallelScan),
+// projected onto projCnt attributes.  open() runs the whole scan and
+// next() returns the tuples the workers buffered, in file order.
+
+class ParallelScanIter : public Iterator
+{
+public:
+  ParallelScanIter(const string & relation, const int threads,
+		   const int projCnt, const AttrDesc projs[],
+		   const int predCnt, const ScanPred preds[],
+		   Status & status);
+  ~ParallelScanIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  vector<ScanPred> preds;
+  ParallelScan*	pscan;
+  int		bufNo;			// buffer of the next tuple
+  int		tupleNo;		// and its position in the buffer
+};
+
+
+// The records of a relation that a scan of index returns.  The scan
+// is started by the caller before the iterator is opened, and the
+// iterator can only be opened once; it owns the index.  The RIDs are
+// fetched INDEXBATCH at a time with getRecords(), which reads each
+// heap page once per batch.
+
+class IndexScanIter : public Iterator
+{
+public:
+  IndexScanIter(const string & relation, Index* index, Status & status);
+  ~IndexScanIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  string	relation;
+  Index*	index;
+  HeapFile*	file;			// while open
+  vector<RID>	rids;			// RIDs of the batch
+  vector<Record> recs;			// and their records
+  vector<char>	buffer;
+  int		recCnt;			// records in the batch
+  int		recNo;			// next one to return
+  bool		done;			// has the index scan ended?
+};
+
+
+// The entries of a B+-tree scan, started by the caller, turned back
+// into as much of their records as the key and the included
+// attributes make up (see BTreeIndex::getCovered()).  The relation is
+// not read; the attributes of the tuples are those the index covers.
+// The iterator owns the index and can only be opened once.
+
+class IndexOnlyIter : public Iterator
+{
+public:
+  IndexOnlyIter(const string & relation, BTreeIndex* index,
+		Status & status);
+  ~IndexOnlyIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  BTreeIndex*	index;
+  vector<char>	covered;		// the tuple
+};
+
+
+// The tuples of child that satisfy the AND of predCnt terms, whose
+// offsets are those of the attributes in the tuples of child.  Like
+// every iterator over other iterators, it owns (and deletes) child.
+
+class FilterIter : public Iterator
+{
+public:
+  FilterIter(Iterator* child, const int predCnt, const ScanPred preds[]);
+  ~FilterIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	child;
+  vector<ScanPred> preds;
+  vector<PredFunc> funcs;
+};
+
+
+// The tuples of child for which `attrs1[i] ops[i] attrs2[i]' holds
+// for each of cmpCnt comparisons between two of its attributes, given
+// by position, such as the terms of a join other than the one it was
+// done on.
+
+class CompareIter : public Iterator
+{
+public:
+  CompareIter(Iterator* child, const int cmpCnt, const int attrs1[],
+	      const Operator ops[], const int attrs2[]);
+  ~CompareIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	child;
+  vector<int>	offsets1, offsets2, lengths;
+  vector<PredFunc> funcs;
+};
+
+
+// The tuples of child cut down to projCnt of its attributes, found by
+// relation and attribute name, in the order given.
+
+class ProjectIter : public Iterator
+{
+public:
+  ProjectIter(Iterator* child, const int projCnt, const AttrDesc projs[],
+	      Status & status);
+  ~ProjectIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	child;
+  vector<int>	from;			// offset of each in a child tuple
+  vector<char>	tuple;
+};
+
+
+// The tuples of child in the order of attribute attrNo.  open() reads
+// all of child into a temporary heap file and sorts it with a
+// SortedFile.  Its runs hold as many tuples as frames pages would, or
+// more if there would otherwise be more runs than frames can keep
+// pinned while they are merged (two frames a run).
+//
+// setMark() and gotoMark() are those of SortedFile: after gotoMark(),
+// next() returns the tuple it returned just before setMark() again.
+
+class SortIter : public Iterator
+{
+public:
+  SortIter(Iterator* child, const int attrNo, const int frames);
+  ~SortIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+  const Status setMark();
+  const Status gotoMark();
+
+private:
+  Iterator*	child;
+  int		attrNo;
+  int		frames;
+  string	tmpName;		// the temporary file, while open
+  SortedFile*	sorted;
+};
+
+
+// The pairs of tuples of outer and inner for which
+// `outer.attr1 op inner.attr2' holds, attr1 and attr2 being the
+// attribute numbers in the tuples of the two.  A tuple of the join is
+// the outer tuple followed by the inner one.  inner is opened once for
+// every outer tuple, so it had better be cheap to open again.
+
+class NLJoinIter : public Iterator
+{
+public:
+  NLJoinIter(Iterator* outer, Iterator* inner, const int attr1,
+	     const Operator op, const int attr2);
+  ~NLJoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	outer;
+  Iterator*	inner;
+  int		offset1, offset2, length;
+  PredFunc	pred;
+  vector<char>	tuple;			// outer tuple, then the join tuple
+  bool		innerOpen;		// is inner open on an outer tuple?
+};
+
+
+// The same join, with the outer tuples read a block of blockPages
+// pages' worth at a time and inner opened once for every block
+// instead.  For EQ, a hash table on the block finds the outer tuples
+// that match an inner one; for other operators the inner tuple is
+// compared with every tuple of the block.  If attr1 is negative, every
+// pair of tuples is joined (a cross product).
+
+class BlockNLJoinIter : public Iterator
+{
+public:
+  BlockNLJoinIter(Iterator* outer, Iterator* inner, const int attr1,
+		  const Operator op, const int attr2, const int blockPages);
+  ~BlockNLJoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	outer;
+  Iterator*	inner;
+  int		outerLen, innerLen;
+  int		offset1, offset2;	// of the join attributes
+  int		keyType, keyLen;
+  PredFunc	pred;			// NULL for a cross product
+  bool		hashed;			// is the block hashed (EQ)?
+  int		blockCnt;		// outer tuples a block holds
+
+  vector<char>	block;			// outer tuples of the block
+  int		rowCnt;			// how many there are
+  vector<int>	heads;			// hash table on them (EQ): first
+  vector<int>	chain;			// row of a chain, next row on one
+  unsigned int	mask;			// hash value -> chain
+  bool		outerDone;		// has outer been read to the end?
+  bool		innerOpen;		// is inner open on the block?
+  bool		innerValid;		// is there an inner tuple?
+  int		row;			// next row to try with it, or -1
+  vector<char>	tuple;
+
+  const Status readBlock();
+};
+
+
+// The pairs of tuples of outer and the relation of attrDesc2 for which
+// `outer.attr1 op attrDesc2' holds, found by probing the index on
+// attrDesc2.  The outer tuples are read OUTERBATCH at a time and
+// probed in the order of their join attribute, so that probes for
+// nearby keys find the index pages they need still in the buffer
+// pool, and a probe for the same key as the one before reuses its
+// RIDs.  The inner tuples of a probe are fetched INNERBATCH at a time
+// with getRecords().
+
+class IndexJoinIter : public Iterator
+{
+public:
+  IndexJoinIter(Iterator* outer, const int attr1, const Operator op,
+		const AttrDesc & attrDesc2, Status & status);
+  ~IndexJoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  Iterator*	outer;
+  int		attr1, offset1;
+  Operator	innerOp;		// the inner tuples with
+  AttrDesc	attrDesc2;		// `attrDesc2 innerOp value' match
+  int		outerLen;
+  PredFunc	sameKey;		// equality of two join values
+
+  Index*	index;			// while open
+  HeapFile*	innerFile;
+
+  vector<char>	outerData;		// the outer tuples of the batch
+  vector<int>	order;			// their offsets in key order
+  unsigned int	outerNo;		// next one in order to probe
+  bool		outerDone;		// has outer run out?
+  const char*	outerTuple;		// tuple being joined
+  const char*	probeKey;		// join value of the last probe
+  vector<RID>	rids;			// inner RIDs of the last probe
+  unsigned int	ridNo;			// next one to fetch
+  vector<Record> innerRecs;		// fetched inner tuples
+  vector<char>	innerData;
+  int		innerCnt;
+  int		innerNo;		// next one to return
+  vector<char>	tuple;
+};
+
+
+// The pairs of tuples of outer and inner for which
+// `outer.attr1 op inner.attr2' holds, found by merging the two, which
+// are sorted on the attributes.  A tuple of the join is the outer
+// tuple followed by the inner one.  op may be anything but NE.
+//
+// For EQ, each outer tuple is joined with the group of inner tuples
+// with its value; the inner input is marked at the start of the group
+// and goes back to the mark for the next outer tuple if it has the
+// same value.  The other operators make band joins: the tuples of one
+// input that match a tuple of the other are a suffix of it, starting
+// further along for each next tuple of the other.  That input is
+// marked at the start of the suffix, which is read once per tuple of
+// the other input.
+
+class MergeJoinIter : public Iterator
+{
+public:
+  MergeJoinIter(SortIter* outer, SortIter* inner, const int attr1,
+		const Operator op, const int attr2);
+  ~MergeJoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+private:
+  SortIter*	outer;
+  SortIter*	inner;
+  int		outerLen;
+  Operator	op;
+  PredFunc	less;			// of two join values
+  int		keyLen;
+
+  SortIter*	drive;			// the input read once
+  SortIter*	scan;			// the input with the mark
+  int		driveKey, scanKey;	// offsets of the join values
+  int		drivePos, scanPos;	// and of the tuples in a join one
+  int		driveLen, scanLen;
+  bool		strict;			// do only scan values above a
+					// drive value match it?
+  Record	scanRec;		// scan's current tuple
+  bool		scanValid;		// is there one?
+  bool		marked;			// has scan been marked?
+  bool		joining;		// joining the drive tuple with scan?
+  vector<char>	groupKey;		// value of the group (EQ)
+  vector<char>	tuple;
+
+  const Status nextScan();
+  const int compare(const char* a, const char* b) const;
+};
+
+
+// The pairs of tuples of outer and inner with equal values of
+// attributes attr1 and attr2, found by a hybrid hash join.  A tuple of
+// the join is the outer tuple followed by the inner one.
+//
+// open() reads inner into partitions by a hash of attr2, keeping them
+// in memory as long as they fit in the frames of the buffer pool that
+// are free at the time.  When they no longer fit, the largest
+// partition in memory is spilled to a temporary heap file in the
+// database, like the runs of a sort, and the rest of its tuples go
+// there too.  The partitions left in memory get hash tables, which
+// next() probes with the outer tuples as they come; the outer tuples
+// of a spilled partition are spilled to a file of their own.
+//
+// Once outer runs out, each pair of spilled partitions is joined the
+// same way, with a new hash function, so an inner partition that did
+// not fit is split again.  One that cannot be split (all of its tuples
+// fell into a single partition, which is what a key that many tuples
+// share does) or that is still too large after HASHLEVELS levels is
+// joined a memory load of inner tuples at a time instead, the outer
+// partition being read once per load.
+//
+// innerPages, an estimate of the pages of inner, sets the number of
+// partitions.
+
+class HashJoinIter : public Iterator
+{
+public:
+  HashJoinIter(Iterator* outer, Iterator* inner, const int attr1,
+	       const int attr2, const int innerPages);
+  ~HashJoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+
+  // partitions for an inner input of innerPages pages when frames
+  // frames of the buffer pool are free
+  static const int partitionCnt(const int innerPages, const int frames);
+
+private:
+  // a partition of the inner tuples and of the outer ones
+  struct HashPart
+  {
+    vector<char>	rows;		// inner tuples, while in memory
+    vector<int>		heads;		// hash table on them: first row
+    vector<int>		chain;		// of a chain, next row on one
+    unsigned int	mask;		// hash value -> chain
+    bool		spilled;	// are the tuples in files instead?
+    string		innerName;	// the files
+    string		outerName;
+    InsertFileScan*	innerFile;	// while being written
+    InsertFileScan*	outerFile;
+    int			innerCnt;	// tuples in the partition
+    int			outerCnt;
+  };
+
+  // a pair of spilled partitions still to be joined
+  struct HashJob
+  {
+    string		innerName;
+    string		outerName;
+    int			innerCnt;
+    int			level;		// times the tuples were split
+    bool		chunked;	// a memory load at a time?
+  };
+
+  Iterator*	outer;
+  Iterator*	inner;
+  int		attr1, attr2;
+  int		innerPages;
+  int		outerLen, innerLen;
+  int		offset1, offset2;	// of the join attributes
+  int		keyType, keyLen;
+  PredFunc	sameKey;
+
+  bool		isOpen;
+  string	tmpName;		// base name of the spill files
+  int		fileCnt;		// spill files made so far
+  int		frames;			// free frames when opened
+  int		filesOpen;		// spill files being written
+  int		memUsed;		// bytes of inner tuples in memory
+
+  vector<HashPart> parts;		// of the tuples being joined
+  unsigned int	seed;			// of their hash function
+  HashJob	job;			// they are those of job, unless
+  bool		fromInputs;		// they came from inner and outer
+  vector<HashJob> jobs;			// still to be joined
+  HeapFileScan*	innerScan;		// of job's inner file, if chunked
+  bool		innerDone;		// has it been read to the end?
+  HeapFileScan*	outerScan;		// of job's outer file
+  bool		outerOpen;		// is outer open?
+
+  HashPart*	probePart;		// partition of the outer tuple
+  int		probeRow;		// next row on its chain, or -1
+  vector<char>	tuple;
+
+  const int budget() const;
+  const Status readInner(Iterator* it, HeapFileScan* scan);
+  const Status readChunk();
+  const Status spill(HashPart & part);
+  const Status buildTables();
+  const Status spillOuter(HashPart & part, const Record & rec);
+  const Status endProbe();
+  const Status startJob();
+  void initParts(const int P);
+  void clearParts();
+};
+
+
+// Run plan to the end.  Its tuples are inserted into relation result,
+// which must exist, or, if result is empty, printed as UT_Print()
+// prints a relation.  Returns the number of tuples in tupleCnt.
+const Status runPlan(Iterator & plan, const string & result, int & tupleCnt);
+
+#endif
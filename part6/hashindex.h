@@ -0,0 +1,121 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include "index.h"
+
+// An extendible hash index maps the values of one attribute of a
+// relation to the RIDs of the records that hold them.  Unlike a
+// B+-tree it can only find the entries with a given value, but it
+// does so by reading one directory page and one bucket page.  Its
+// pages are kept in a file of their own and go through the buffer
+// manager.
+//
+// The directory has 2^globalDepth entries, each the page number of a
+// bucket; a key belongs to the bucket picked by the low globalDepth
+// bits of its hash value.  A bucket of local depth d is shared by the
+// directory entries that agree on their low d bits.  A bucket that
+// overflows is split on bit d into two buckets of depth d + 1, and
+// the directory is doubled first if d equals globalDepth.  The
+// directory is kept on directory pages listed in the header page, so
+// it can double until MAXHASHDIRPAGES of them are in use.
+//
+// Splitting cannot separate entries that all have the same hash value
+// (a key repeated many times), and buckets stop splitting once the
+// directory is as large as it can be.  Such a bucket gets a chain of
+// overflow pages instead, which later splits of the bucket share out
+// again.  Buckets are not merged when entries are deleted.
+
+struct HashBucketHdr
+{
+  int		localDepth;		// bits of the hash value it covers
+  int		keyCnt;			// number of entries on the page
+  int		overflowPage;		// next page of the bucket, -1 if none
+};
+
+const int HASHDIRENTRIES = PAGESIZE / sizeof(int);
+const int MAXHASHDIRPAGES = (PAGESIZE - 7 * sizeof(int)) / sizeof(int);
+
+struct HashHdrPage
+{
+  int		globalDepth;		// log2 of the directory size
+  int		bucketCnt;		// buckets (not counting overflow pages)
+  int		attrOffset;		// offset of the key in a record
+  int		attrType;		// Datatype of the key
+  int		attrLen;		// length of the key
+  int		entryCnt;		// entries in the index
+  int		dirCnt;			// number of directory pages
+  int		dirPages[MAXHASHDIRPAGES]; // page numbers of directory pages
+};
+
+
+// hash value of an attribute value; strings are hashed up to their
+// first null character, since they compare equal up to there
+unsigned long long hashValue(const char *value, int length, const int type);
+
+
+class HashIndex : public Index
+{
+public:
+  // create the index on an attribute of relation, with (at least)
+  // bucketCnt buckets to start with
+  static const Status create(const string & relation,
+			     const string & attrName,
+			     const int attrOffset,
+			     const int attrType,
+			     const int attrLen,
+			     const int bucketCnt);
+
+  // destroy the index on an attribute of relation
+  static const Status destroy(const string & relation,
+			      const string & attrName);
+
+  // open the index on an attribute of relation
+  HashIndex(const string & relation, const string & attrName,
+	    Status & status);
+  ~HashIndex();
+
+  // add / remove the entry for the record rec with RID rid
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+
+  // start a scan of the entries whose key equals value
+  const Status startScan(const char* value);
+
+  // return the RID of the next entry of the scan, NOMORERECS at end
+  const Status scanNext(RID & outRid);
+
+  // terminate the scan
+  const Status endScan();
+
+  const int getEntryCnt() const { return hdr->entryCnt; }
+  const int getBucketCnt() const { return hdr->bucketCnt; }
+
+private:
+  File*		filePtr;		// the index file
+  int		hdrPageNo;		// page number of its header page
+  HashHdrPage*	hdr;			// header page, pinned
+  bool		hdrDirty;
+
+  int		keyLen;			// bytes of a key
+  int		entLen;			// bytes of an entry
+  int		bucketCap;		// entries that fit on a bucket page
+
+  int		scanPageNo;		// bucket page of the scan, -1 if none
+  char*		scanBucket;		// that page, pinned
+  int		scanPos;		// next entry of it to look at
+  vector<char>	scanKey;		// key the scan looks for
+
+  char* bucketEntry(char* bucket, const int i) const;
+  const int keyCmp(const char* a, const char* b) const;
+  void makeKey(const char* value, char key[]) const;
+  const unsigned int hashOf(const char* key) const;
+
+  const Status getBucket(const unsigned int hash, int & pageNo);
+  const Status setBucket(const int dirIdx, const int pageNo);
+  const Status doubleDirectory();
+  const Status splitBucket(const int pageNo, const unsigned int hash);
+  const Status writeChain(const int pageNo, const int localDepth,
+			  const char* ents, const int cnt);
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include <functional>
 #include <iostream>
 #include <vector>
+#include <unordered_map>
 #include <string.h>
 #include <assert.h>
 #include "stdlib.h"
@@ -24,6 +25,68 @@ const unsigned MAXNAMESIZE = 50;
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
 
+// A compiled scan predicate.  startScan() picks one instantiation of
+// a templated comparator per (type, operator, length class) so that
+// matchRec() makes a single indirect call instead of re-dispatching
+// on the type and the operator for every record.
+typedef bool (*PredFunc)(const char* attr, const char* filter, const int length);
+
+// pick the comparator for a (type, operator, length class) combination
+PredFunc compilePred(const Datatype type, const int length, const Operator op);
+
+// one conjunct of a scan predicate: attr op filter
+struct ScanPred
+{
+  int		offset;		// byte offset of filter attribute
+  int		length;		// length of filter attribute
+  Datatype	type;		// datatype of filter attribute
+  const char*	filter;		// comparison value of filter
+  Operator	op;		// comparison operator of filter
+};
+
+// The data pages of a heap file are listed, in file order, in a page
+// directory so that the k-th data page can be found without walking
+// the page chain.  The directory is an array of directory pages that
+// each hold DIRPAGEENTRIES data page numbers; the page numbers of the
+// directory pages themselves are kept in the file header page.
+const int DIRPAGEENTRIES = PAGESIZE / sizeof(int);
+const int MAXDIRPAGES = (PAGESIZE - MAXNAMESIZE - 8 * sizeof(int))
+			/ sizeof(int);
+
+struct DirPage
+{
+  int		pageNo[DIRPAGEENTRIES]; // data page numbers
+};
+
+// a scan predicate term translated for the zone map (zonemap.h)
+#define ZONEKEYLEN	8		// bytes of a min/max key
+
+struct ZoneCheck
+{
+  int		col;			// tracked attribute it refers to
+  Operator	op;			// comparison operator
+  char		key[ZONEKEYLEN];	// comparison value as a key
+};
+
+class ZoneMap;
+
+// statistics of a HeapFileScan, reset by startScan()
+struct ScanStats
+{
+  int pagesRead;     // data pages read by the scan
+  int pagesSkipped;  // data pages skipped using the zone map
+
+  void clear()
+    {
+      pagesRead = pagesSkipped = 0;
+    }
+
+  ScanStats()
+    {
+      clear();
+    }
+};
+
 struct FileHdrPage
 {
   char		fileName[MAXNAMESIZE];   // name of file
@@ -31,6 +94,8 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		dirCnt;		// number of directory pages
+  int		dirPages[MAXDIRPAGES];	// pageNos of directory pages
 };
 
 
@@ -46,6 +111,16 @@ protected:
    int   	curPageNo;	// page number of pinned page
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
+   ZoneMap*	zoneMap;	// zone map of the file, NULL if none
+   unordered_map<int, int> dirIndex; // data page number -> directory
+				// index, once dirIndexBuilt
+   bool		dirIndexBuilt;
+
+   // add a data page to the end of the page directory
+   const Status appendPage(const int pageNo);
+
+   // find the directory index of data page pageNo
+   const Status findPage(const int pageNo, int & idx);
 
 public:
 
@@ -58,8 +133,35 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
+  // return page number of the idx-th data page (0 is the first)
+  const Status getPageNo(const int idx, int & pageNo);
+
+  // split the data pages into n ranges of (nearly) equal size; range
+  // i is [bounds[i], bounds[i+1])
+  void pageRanges(const int n, vector<int> & bounds) const;
+
+  // unlink the idx-th data page from the file and dispose of it
+  const Status removePage(const int idx);
+
+  // move the records of up to maxPages of the last data pages into
+  // free space on earlier pages, removing the pages that are emptied;
+  // pages before fillIdx are taken to be full
+  const Status compact(int & fillIdx, const int maxPages, int & pagesFreed);
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // given a RID, delete the record from the file
+  const Status deleteRecord(const RID & rid);
+
+  // read the records with the ridCnt RIDs in rids, pinning each page
+  // once; the records are copied into buffer and recs[i] is the
+  // record with RID rids[i]
+  const Status getRecords(const int ridCnt, const RID rids[],
+			  vector<char> & buffer, Record recs[]);
 };
 
 
@@ -78,6 +180,12 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // start a scan whose predicate is the AND of predCnt conjuncts
+    const Status startScan(const int predCnt, const ScanPred preds[]);
+
+    // restrict the scan to data pages firstIdx .. endIdx-1
+    const Status setPageRange(const int firstIdx, const int endIdx);
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
@@ -85,6 +193,9 @@ public:
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
 
+    // return the records of the next page of the scan, unfiltered
+    const Status scanNextPage(vector<Record> & recs);
+
     // read current record, returning pointer and length
     const Status getRecord(Record & rec);
 
@@ -94,21 +205,47 @@ public:
     // marks current page of scan dirty
     const Status markDirty();
 
+    // pages read and skipped since startScan()
+    const ScanStats & getScanStats() const
+    {
+      return scanStats;
+    }
+
 private:
-    int   offset;            // byte offset of filter attribute
-    int   length;            // length of filter attribute
-    Datatype type;           // datatype of filter attribute
-    const char* filter;      // comparison value of filter
-    Operator op;             // comparison operator of filter
+    // a compiled conjunct along with the counts used to estimate
+    // its selectivity while the scan runs
+    struct ScanTerm
+    {
+      int	offset;		// byte offset of filter attribute
+      int	length;		// length of filter attribute
+      const char* filter;	// comparison value of filter
+      PredFunc	pred;		// comparator compiled for the filter
+      int	evalCnt;	// records this term was evaluated on
+      int	passCnt;	// records that satisfied it
+    };
+
+    vector<ScanTerm> terms;  // conjuncts, most selective first
+    int   matchCnt;          // matchRec() calls since last reordering
+
+    int   curIdx;            // directory index of current page
+    int   firstIdx;          // page range of the scan; endIdx is -1
+    int   endIdx;            // when the whole file is scanned
+
+    vector<ZoneCheck> zoneChecks; // terms the zone map can check
+    ScanStats scanStats;
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
     // A subsequent invocation of resetScan() will cause the
     // scan to be rolled back to the following
     int   markedPageNo;	// page number of pinned page
+    int   markedIdx;         // directory index of that page
     RID   markedRec;         // rid of last record returned
 
-    const bool matchRec(const Record & rec) const;
+    const Status nextScanPage(int & nextIdx, int & nextPageNo);
+    const Status findScanPage(int & idx, int & pageNo);
+    const bool matchRec(const Record & rec);
+    void reorderTerms();     // sort terms by observed selectivity
 };
 
 
@@ -123,6 +260,38 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // insert recCnt records, packing them into new pages as needed;
+    // their RIDs are returned in outRids unless it is NULL
+    const Status insertBatch(const Record recs[], const int recCnt,
+			     RID outRids[]);
+};
+
+
+// Collects records in memory and inserts them into an InsertFileScan
+// with insertBatch() once INSERTBUFSIZE bytes have piled up (and on
+// flush()).  The caller must call flush() when done; the destructor
+// does not, since it could not report an error.
+
+#define INSERTBUFSIZE	((int)(32 * PAGESIZE))
+
+class InsertBuffer
+{
+public:
+    InsertBuffer(InsertFileScan & file);
+    ~InsertBuffer();
+
+    // copy rec into the buffer, flushing the buffer first if it is full
+    const Status add(const Record & rec);
+
+    // insert the buffered records into the file
+    const Status flush();
+
+private:
+    InsertFileScan & file;
+    char*	data;		// buffered record contents
+    int		used;		// bytes of data in use
+    vector<Record> recs;	// buffered records, pointing into data
 };
 
 #endif
@@ -0,0 +1,70 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+
+// What inserts, deletes and selections need of an index of any kind.
+// Scans are started through the particular kind of index, since what
+// they can be asked for differs (see BTreeIndex and HashIndex).
+
+class Index
+{
+public:
+  virtual ~Index() {}
+
+  // add / remove the entry for the record rec with RID rid
+  virtual const Status insertEntry(const Record & rec, const RID & rid) = 0;
+  virtual const Status deleteEntry(const Record & rec, const RID & rid) = 0;
+
+  // return the RID of the next entry of the scan, NOMORERECS at end
+  virtual const Status scanNext(RID & outRid) = 0;
+
+  // terminate the scan
+  virtual const Status endScan() = 0;
+};
+
+
+// The indexes of a relation, opened together so that a change to the
+// relation can be applied to all of them.  Which attributes are
+// indexed, and how, is recorded in the attribute catalog
+// (AttrDesc.indexed).
+
+class IndexSet
+{
+public:
+  // open all of the indexes of relation (there may be none)
+  IndexSet(const string & relation, Status & status);
+  ~IndexSet();
+
+  // does the relation have no indexes?
+  const bool empty() const { return indexes.empty(); }
+
+  // add / remove the entries for record rec, whose RID is rid
+  const Status insertEntries(const Record & rec, const RID & rid);
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+private:
+  vector<Index*> indexes;
+};
+
+
+// open the index on attribute ad, of whatever kind it is
+Index* openIndex(const AttrDesc & ad, Status & status);
+
+// can the index on attribute ad (if any) find the keys k that satisfy
+// `k op value'?
+const bool indexAnswers(const AttrDesc & ad, const Operator op);
+
+// start a scan of index, the index on attribute ad, for the keys k
+// that satisfy `k op value'
+const Status startIndexScan(Index* index, const AttrDesc & ad,
+			    const char* value, const Operator op);
+
+
+// build the indexes of a relation again, e.g. after its records moved
+const Status rebuildIndexes(const string & relation);
+
+// destroy the index files of a relation that is being destroyed
+const Status destroyIndexes(const string & relation);
+
+#endif
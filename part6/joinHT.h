@@ -1,3 +1,16 @@
+#ifndef JOINHT_H
+#define JOINHT_H
+
+#include "catalog.h"
+
+// hash of a join attribute value of type attrType and attrLen bytes,
+// mixed with seed; equal values (strings up to their terminating null)
+// hash alike.  Hash joins partition their inputs with one seed and
+// build their joinHashTbls with another, so that the tuples of a
+// partition do not all fall on a few chains.
+const unsigned int hashAttr(const char* attr, const int attrType,
+			    const int attrLen, const unsigned int seed);
+
 
 class joinHashTbl
 {
@@ -25,7 +38,7 @@ private:
     AttrDesc 	joinAttr;
     int 	HTSIZE;
     HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int  hash(const char* attr); // returns value between 0 and HTSIZE-1
 
 public:
     joinHashTbl(const int size, const AttrDesc attr);  // constructor
@@ -38,3 +51,4 @@ public:
      Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
 };
 
+#endif
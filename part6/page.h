@@ -56,6 +56,11 @@ public:
     // inserts a new record (rec) into the page, returns RID of record 
     const Status insertRecord(const Record & rec, RID& rid);
 
+    // appends records to the page in new slots until one does not fit,
+    // returns the number of records placed and their RIDs (if rids
+    // is not NULL)
+    const int appendRecords(const Record recs[], const int recCnt, RID rids[]);
+
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
@@ -57,6 +57,8 @@ typedef enum {
     N_LOAD,
     N_PRINT,
     N_HELP,
+    N_VACUUM,
+    N_ANALYZE,
     N_SELECT,
     N_JOIN,
     N_PRIMATTR,
@@ -113,6 +115,9 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    int fillfactor;
+	    int bitmap;
+	    struct node *include;
 	} BUILD;
 
 	// drop node */
@@ -137,6 +142,16 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// vacuum node */
+	struct {
+	    char *relname;
+	} VACUUM;
+
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -217,12 +232,15 @@ NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets,
+		 int fillfactor, int bitmap, NODE *include);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *vacuum_node(char *relname);
+NODE *analyze_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
 NODE *qualattr_node(char *relname, char *attrname);
@@ -72,6 +72,13 @@ static NODE *parse_tree;                // root of parse tree
 		T_QSTRING
 		T_SHELL_CMD
 
+/* new reserved words go here, so the other tokens keep their values */
+%token		RW_VACUUM
+		RW_ANALYZE
+		RW_FILLFACTOR
+		RW_BITMAP
+		RW_INCLUDE
+
 %type	<ival>	op
 
 %type	<sval>	opt_into_relname
@@ -93,9 +100,12 @@ static NODE *parse_tree;                // root of parse tree
 		print
 		help
 		quit
+		vacuum
+		analyze
 		opt_primary_attr
 		opt_where
 		qual
+		term
 		selection
 		join
 		non_mt_qualattr_list
@@ -156,6 +166,8 @@ command
 	| print
 	| help
 	| quit
+	| vacuum
+	| analyze
 	| nothing
 	{
 		$$ = NULL;
@@ -272,7 +284,28 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, 0, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	{
+		$$ = build_node($2, $4, $8, 0, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_FILLFACTOR T_EQ T_INT
+	{
+		$$ = build_node($2, $4, 0, $8, 0, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_BITMAP
+	{
+		$$ = build_node($2, $4, 0, 0, 1, NULL);
+	}
+	| RW_BUILD string '(' string ')' RW_INCLUDE '(' attrib_list ')'
+	{
+		$$ = build_node($2, $4, 0, 0, 0, $8);
+	}
+	| RW_BUILD string '(' string ')' RW_INCLUDE '(' attrib_list ')'
+	  RW_FILLFACTOR T_EQ T_INT
+	{
+		$$ = build_node($2, $4, 0, $12, 0, $8);
 	}
 	;
 
@@ -316,6 +349,20 @@ help
 	}
 	;
 
+vacuum
+	: RW_VACUUM string
+	{
+		$$ = vacuum_node($2);
+	}
+	;
+
+analyze
+	: RW_ANALYZE string
+	{
+		$$ = analyze_node($2);
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
@@ -368,6 +415,14 @@ opt_where
 	;
 
 qual
+	: term
+	| term RW_AND qual
+	{
+		$$ = prepend($1, ($3->kind == N_LIST) ? $3 : list_node($3));
+	}
+	;
+
+term
 	: selection
 	| join
 	;
@@ -93,7 +93,12 @@ extern int yydebug;
     T_REAL = 294,                  /* T_REAL  */
     T_STRING = 295,                /* T_STRING  */
     T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    T_SHELL_CMD = 297,             /* T_SHELL_CMD  */
+    RW_VACUUM = 298,               /* RW_VACUUM  */
+    RW_ANALYZE = 299,              /* RW_ANALYZE  */
+    RW_FILLFACTOR = 300,           /* RW_FILLFACTOR  */
+    RW_BITMAP = 301,               /* RW_BITMAP  */
+    RW_INCLUDE = 302               /* RW_INCLUDE  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -142,6 +147,11 @@ extern int yydebug;
 #define T_STRING 295
 #define T_QSTRING 296
 #define T_SHELL_CMD 297
+#define RW_VACUUM 298
+#define RW_ANALYZE 299
+#define RW_FILLFACTOR 300
+#define RW_BITMAP 301
+#define RW_INCLUDE 302
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -154,7 +164,7 @@ union YYSTYPE
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 168 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
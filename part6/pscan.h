@@ -0,0 +1,66 @@
+#ifndef PSCAN_H
+#define PSCAN_H
+
+#include "catalog.h"
+
+// define if debug output wanted
+//#define DEBUGPSCAN
+
+#define MAXSCANTHREADS 16               // upper limit on scan workers
+
+
+// A filtered, projecting scan of a heap file that runs on several
+// threads.  The data pages of the file are split into one page range
+// per worker (see HeapFile::pageRanges()); each worker runs its own
+// HeapFileScan over its range and appends the projected tuples that
+// qualify to a buffer of its own, so the workers share nothing but the
+// buffer manager.  The buffers are kept in page range order, so
+// reading them back one after the other gives the tuples in the same
+// order as a single HeapFileScan would.
+
+class ParallelScan {
+ public:
+  ParallelScan(const string & relation,  // heap file to scan
+	       const int threads,         // number of workers
+	       const int projCnt,         // attributes of the output
+	       const AttrDesc projs[],    // tuples, in order
+	       Status & status);
+  ~ParallelScan();
+
+  // run the scan with the AND of predCnt conjuncts as its predicate
+  const Status run(const int predCnt, const ScanPred preds[]);
+
+  // number of tuples produced by the last run()
+  const int getTupleCnt() const;
+
+  // the tuples in buffer i (0 <= i < getBufferCnt()); tupleCnt tuples
+  // of getTupleLen() bytes each, packed one after the other
+  const int getBufferCnt() const { return threads; }
+  const int getTupleLen() const { return tupleLen; }
+  const char* getBuffer(const int i, int & tupleCnt) const;
+
+  // insert the tuples of the last run() into a heap file, in order
+  const Status insertInto(InsertFileScan & out) const;
+
+ private:
+  struct Worker {
+    ParallelScan* scan;                 // scan this worker belongs to
+    int firstIdx, endIdx;               // page range of the worker
+    const ScanPred* preds;              // predicate of the scan
+    int predCnt;
+    vector<char> buffer;                // projected output tuples
+    int tupleCnt;                       // tuples in buffer
+    Status status;                      // outcome of the worker
+  };
+
+  static void scanRange(Worker* w);    // body of one worker thread
+
+  string relation;
+  int threads;
+  int projCnt;
+  AttrDesc* projs;
+  int tupleLen;                         // length of an output tuple
+  vector<Worker> workers;
+};
+
+#endif
@@ -3,7 +3,7 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+enum JoinType {NLJoin, SMJoin, HashJoin, BNLJoin, IndexJoin, AutoJoin};
 
 //
 // Prototypes for query layer functions
@@ -13,9 +13,9 @@ enum JoinType {NLJoin, SMJoin, HashJoin};
 const Status QU_Select(const string & result, 
 		       const int projCnt, 
 		       const attrInfo projNames[],
-		       const attrInfo *attr, 
-		       const Operator op, 
-		       const char *attrValue);
+		       const int qualCnt,
+		       const attrInfo quals[],
+		       const Operator ops[]);
 
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
@@ -24,6 +24,17 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+const Status QU_MultiJoin(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const int qualCnt,
+			  const attrInfo quals[],
+			  const Operator qualOps[],
+			  const int joinCnt,
+			  const attrInfo joinAttrs1[],
+			  const Operator joinOps[],
+			  const attrInfo joinAttrs2[]);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
@@ -19,12 +19,23 @@ typedef struct {
 } SORTREC;
 
 
+// With keysOnly set, the sub-runs hold just the sort attribute and
+// the RID of each source record, and next() returns records made of
+// the two (length + sizeof(RID) bytes).  Records with equal attributes
+// then come out in RID order, and strings are padded with nulls past
+// their end, so the order is that of a B+-tree (see BTreeIndex).
+// The records may also carry other attributes of the source records,
+// carryCnt of them, which follow the RID in the order given.
+
 class SortedFile {
  public:
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     bool keysOnly = false,
+	     int carryCnt = 0, const int carryOffsets[] = NULL,
+	     const int carryLens[] = NULL);
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -54,6 +65,10 @@ class SortedFile {
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
+  bool keysOnly;                        // runs hold attribute + RID only
+  vector<int> carryOffsets;             // and these attributes
+  vector<int> carryLens;
+  int carryLen;                         // bytes of them
 
   SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer
@@ -15,6 +15,7 @@
 #include <string.h>
 using namespace std;
 #include "error.h"
+#include "catalog.h"
 
 // define if debug output wanted
 
@@ -27,6 +28,31 @@ const Status UT_Load(const string & relation,
 
 const Status UT_Print(string relation);
 
+// the column widths UT_Print() uses for attributes attrs, and the
+// printing of one record in them
+const Status UT_computeWidth(const int attrCnt,
+			     const AttrDesc attrs[],
+			     int *&attrWidth);
+
+void UT_printRec(const int attrCnt,
+		 const AttrDesc attrs[],
+		 int *attrWidth,
+		 const Record & rec);
+
+const Status UT_Vacuum(const string & relation);
+
+const Status UT_Analyze(const string & relation);
+
+const Status UT_BuildIndex(const string & relation,
+			   const string & attrName,
+			   const IndexKind kind,
+			   const int param,
+			   const int includeCnt = 0,
+			   char* includeNames[] = NULL);
+
+const Status UT_DropIndex(const string & relation,
+			  const string & attrName);
+
 void   UT_Quit(void);
 
 #endif
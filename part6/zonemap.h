@@ -0,0 +1,114 @@
+#ifndef ZONEMAP_H
+#define ZONEMAP_H
+
+#include "heapfile.h"
+
+// define if debug output wanted
+//#define DEBUGZONE
+
+// A zone map keeps, for every data page of a heap file, the number of
+// records on the page and the smallest and largest value of each
+// tracked attribute.  A scan can then skip a page without reading it
+// when no value in [min, max] can satisfy its predicate, and skip
+// pages that hold no records at all.
+//
+// The zone map of heap file "r" is kept in the file "r.zm".  After
+// its header page the file is a sequence of chunks; chunk c covers
+// data pages c*ZONECHUNK .. (c+1)*ZONECHUNK-1 (directory indexes, see
+// HeapFile::getPageNo()) and consists of colCnt+1 consecutive pages:
+// first the record counts, then one page of ZoneEntry's per tracked
+// attribute.  Since pages are never disposed of in the zone map file,
+// the page holding an entry can be computed instead of looked up.
+//
+// Minimums and maximums only ever widen while a page is in use;
+// deleting records lowers the record count but leaves the range
+// alone, so the range stays a (possibly loose) bound.  Once a page
+// has no records its range is reset by the next insert.  Strings are
+// summarized by their first ZONEKEYLEN bytes, which gives a
+// conservative bound for longer strings.  Minirel has no null values,
+// so the record count is the only flag kept.  (ZoneCheck, the form a
+// scan predicate term takes for the zone map, is in heapfile.h.)
+
+struct ZoneEntry
+{
+  char		min[ZONEKEYLEN];	// smallest value on the page
+  char		max[ZONEKEYLEN];	// largest value on the page
+};
+
+const int ZONECHUNK = PAGESIZE / sizeof(ZoneEntry);
+
+// an attribute covered by the zone map
+struct ZoneCol
+{
+  int		offset;			// byte offset in the record
+  int		length;			// length of the attribute
+  int		type;			// Datatype of the attribute
+};
+
+const int MAXZONECOLS = (PAGESIZE - 3 * sizeof(int)) / sizeof(ZoneCol);
+
+struct ZoneHdrPage
+{
+  int		colCnt;			// number of tracked attributes
+  int		chunkCnt;		// number of chunks allocated
+  int		firstPage;		// page number of first chunk page
+  ZoneCol	cols[MAXZONECOLS];	// the tracked attributes
+};
+
+
+// turn an attribute value into a key, and compare two keys of the
+// given type (<0, 0 or >0 like strcmp); the statistics catalog keeps
+// its min, max and histogram values as such keys too
+void makeZoneKey(const char* attr, const int length, const int type,
+		 char key[]);
+int zoneKeyCmp(const char* a, const char* b, const int type);
+
+
+class ZoneMap
+{
+public:
+  // create the (empty) zone map of heap file fileName
+  static const Status create(const string & fileName,
+			     const int colCnt, const ZoneCol cols[]);
+
+  // destroy the zone map of heap file fileName
+  static const Status destroy(const string & fileName);
+
+  // open the zone map of heap file fileName
+  ZoneMap(const string & fileName, Status & status);
+  ~ZoneMap();
+
+  // translate a scan predicate term; returns false if the zone map
+  // does not track its attribute
+  const bool makeCheck(const ScanPred & pred, ZoneCheck & check) const;
+
+  // can data page idx hold a record that passes all of the checks?
+  const Status mayMatch(const int idx, const int checkCnt,
+			const ZoneCheck checks[], bool & result);
+
+  // record rec was inserted into / a record deleted from data page idx
+  const Status noteInsert(const int idx, const Record & rec);
+  const Status noteDelete(const int idx);
+
+  // data page idx was removed from a file of pageCnt data pages
+  const Status removePage(const int idx, const int pageCnt);
+
+  // write the cached entries of the last page inserted into
+  const Status flush();
+
+private:
+  File*		filePtr;		// the zone map file
+  int		hdrPageNo;		// page number of its header page
+  ZoneHdrPage*	hdr;			// header page, pinned
+
+  int		cacheIdx;		// data page the cache is for, or -1
+  int		cacheCnt;		// its record count
+  vector<ZoneEntry> cache;		// its entries, one per column
+  bool		cacheDirty;
+
+  const int pageOf(const int idx, const int j) const;
+  const Status load(const int idx);
+  const Status addChunk();
+};
+
+#endif